@@ -0,0 +1,214 @@
+@echo off
+setlocal enabledelayedexpansion
+chcp 65001 >nul
+
+color 0a
+title LARAVEL PORTATIL :: BENCHMARK DO MARIADB
+
+:: Uso: benchmark.bat [porta]
+:: Sem porta, usa a porta que o start.bat registrou em logs\mariadb.port.
+
+set "BASE=%~dp0"
+set "MARIADB_DIR=%BASE%mariadb"
+set "MARIADB_MYSQL=%MARIADB_DIR%\bin\mysql.exe"
+set "MARIADB_SLAP=%MARIADB_DIR%\bin\mysqlslap.exe"
+set "MARIADB_DATA=%MARIADB_DIR%\data"
+set "MARIADB_PORT=%~1"
+set "MARIADB_PORT_FILE=%BASE%logs\mariadb.port"
+set "SERVER_DATADIR="
+set "BENCH_HOST=127.0.0.1"
+set "BENCH_DB=bench_portatil"
+set "BENCH_ITERATIONS=5"
+set "BENCH_TOLERANCE=10"
+set "BENCH_DIR=%BASE%logs\benchmark"
+set "BENCH_RESULT=%BENCH_DIR%\ultimo.csv"
+set "BENCH_BASELINE=%BENCH_DIR%\baseline.csv"
+set "BENCH_TMP=%BENCH_DIR%\slap.tmp"
+set "BENCH_ERR=%BENCH_DIR%\slap_erro.txt"
+set "REGRESSIONS=0"
+set "BENCH_FAILED=0"
+
+echo ===============================================
+echo   BENCHMARK DOS COMPONENTES DO MARIADB
+echo ===============================================
+echo.
+
+if not exist "%MARIADB_MYSQL%" (
+    echo [ERRO] Cliente mysql.exe nao encontrado em "%MARIADB_MYSQL%".
+    goto fatal
+)
+
+if not exist "%MARIADB_SLAP%" (
+    echo [ERRO] mysqlslap.exe nao encontrado em "%MARIADB_SLAP%".
+    goto fatal
+)
+
+if not defined MARIADB_PORT (
+    if exist "%MARIADB_PORT_FILE%" (
+        set /P "MARIADB_PORT=" <"%MARIADB_PORT_FILE%"
+    )
+)
+
+if not defined MARIADB_PORT (
+    echo [ERRO] Porta do MariaDB desconhecida: "%MARIADB_PORT_FILE%" nao encontrado.
+    echo        Inicie o servidor com start.bat ou informe a porta: benchmark.bat ^<porta^>
+    goto fatal
+)
+
+for /f "usebackq delims=" %%D in (`call "%MARIADB_MYSQL%" -u root -h %BENCH_HOST% -P %MARIADB_PORT% -N -B -r -e "SELECT @@datadir" 2^>nul`) do (
+    set "SERVER_DATADIR=%%D"
+)
+
+if not defined SERVER_DATADIR (
+    echo [ERRO] Nao foi possivel conectar ao MariaDB em %BENCH_HOST%:%MARIADB_PORT% como root.
+    goto fatal
+)
+
+:: Garante que a porta pertence ao MariaDB do pendrive antes de criar ou apagar bancos.
+call :NormalizeWinPath "%SERVER_DATADIR%" SERVER_DATADIR
+call :NormalizeWinPath "%MARIADB_DATA%" EXPECTED_DATADIR
+if /I not "%SERVER_DATADIR%"=="%EXPECTED_DATADIR%" (
+    echo [ERRO] O servidor na porta %MARIADB_PORT% usa o datadir "%SERVER_DATADIR%",
+    echo        e nao "%EXPECTED_DATADIR%". Ele nao e o MariaDB deste pacote; nada foi alterado.
+    goto fatal
+)
+
+if not exist "%BENCH_DIR%" (
+    mkdir "%BENCH_DIR%" >nul 2>&1
+    if errorlevel 1 (
+        echo [ERRO] Falha ao criar a pasta de resultados em "%BENCH_DIR%".
+        goto fatal
+    )
+)
+
+echo [INFO] Preparando banco "%BENCH_DB%" com dados sinteticos na porta %MARIADB_PORT%...
+"%MARIADB_MYSQL%" -u root -h %BENCH_HOST% -P %MARIADB_PORT% -e "DROP DATABASE IF EXISTS %BENCH_DB%; CREATE DATABASE %BENCH_DB% CHARACTER SET utf8mb4 COLLATE utf8mb4_unicode_ci; CREATE TABLE %BENCH_DB%.t_pk (id INT PRIMARY KEY, v INT) ENGINE=InnoDB; INSERT INTO %BENCH_DB%.t_pk SELECT seq, seq * 7 FROM %BENCH_DB%.seq_1_to_100000"
+if errorlevel 1 (
+    echo [ERRO] Falha ao preparar o banco de benchmark.
+    goto fatal
+)
+
+>"%BENCH_RESULT%" echo benchmark,media_ms,min_ms,max_ms
+
+:: Cada caso isola um componente: ordenacao (filesort), join buffer, JSON,
+:: collation UCA com Unique, DECIMAL e o caminho curto de uma consulta por PK
+:: (MDL, cache de tabelas e MEM_ROOT por comando).
+call :RunBench filesort 1 5 "SELECT seq FROM seq_1_to_200000 ORDER BY MOD(seq, 1000), seq DESC LIMIT 1 OFFSET 199990"
+call :RunBench join_cache 1 5 "SELECT COUNT(*) FROM seq_1_to_2000 a JOIN seq_1_to_2000 b ON MOD(a.seq, 100) = MOD(b.seq, 100)"
+call :RunBench json 1 5 "SELECT SUM(JSON_VALUE(JSON_OBJECT('id', seq, 'tags', JSON_ARRAY(seq, seq * 2)), '$.tags[1]')) FROM seq_1_to_50000"
+call :RunBench collation_sort 1 5 "SELECT CONVERT(CONCAT('Nome ', seq) USING utf8mb4) COLLATE utf8mb4_unicode_ci AS n FROM seq_1_to_100000 ORDER BY n DESC LIMIT 1 OFFSET 99990"
+call :RunBench collation_unique 1 5 "SELECT COUNT(DISTINCT CONVERT(CONCAT('Nome ', MOD(seq, 5000)) USING utf8mb4) COLLATE utf8mb4_unicode_ci) FROM seq_1_to_200000"
+call :RunBench decimal_sum 1 5 "SELECT SUM(CAST(seq AS DECIMAL(15,2)) * 1.07), AVG(CAST(seq AS DECIMAL(15,2))) FROM seq_1_to_200000"
+call :RunBench point_select 8 20000 "SELECT v FROM t_pk WHERE id = 4242"
+
+"%MARIADB_MYSQL%" -u root -h %BENCH_HOST% -P %MARIADB_PORT% -e "DROP DATABASE IF EXISTS %BENCH_DB%" >nul 2>&1
+del /Q "%BENCH_TMP%" "%BENCH_ERR%" >nul 2>&1
+
+echo.
+echo [INFO] Resultados gravados em "%BENCH_RESULT%".
+
+if not "%BENCH_FAILED%"=="0" (
+    echo [ERRO] Um ou mais casos falharam. Veja as mensagens acima; o baseline nao foi alterado.
+    goto fatal
+)
+
+if not exist "%BENCH_BASELINE%" (
+    copy /Y "%BENCH_RESULT%" "%BENCH_BASELINE%" >nul
+    echo [INFO] Nenhum baseline encontrado; esta execucao foi salva como baseline em "%BENCH_BASELINE%".
+    echo        Apague esse arquivo para gravar um novo baseline.
+)
+
+if not "%REGRESSIONS%"=="0" (
+    echo [ALERTA] %REGRESSIONS% caso^(s^) ficaram mais de %BENCH_TOLERANCE%%% acima do baseline.
+    pause
+    exit /b 2
+)
+
+echo [SUCESSO] Benchmark concluido sem regressoes acima de %BENCH_TOLERANCE%%%.
+pause
+exit /b 0
+
+:fatal
+echo.
+echo [ERRO] Benchmark interrompido. Verifique as mensagens acima e tente novamente.
+pause
+exit /b 1
+
+:RunBench
+setlocal
+set "BENCH_NAME=%~1"
+set "BENCH_CONCURRENCY=%~2"
+set "BENCH_QUERIES=%~3"
+set "BENCH_QUERY=%~4"
+set "IS_REGRESSION=0"
+set "IS_FAILURE=0"
+set "AVG_MS="
+set "MIN_MS="
+set "MAX_MS="
+set "BASE_MS="
+
+del /Q "%BENCH_TMP%" >nul 2>&1
+"%MARIADB_SLAP%" -u root -h %BENCH_HOST% -P %MARIADB_PORT% --create-schema=%BENCH_DB% --no-drop --iterations=%BENCH_ITERATIONS% --concurrency=%BENCH_CONCURRENCY% --number-of-queries=%BENCH_QUERIES% --query="%BENCH_QUERY%" --csv="%BENCH_TMP%" >nul 2>"%BENCH_ERR%"
+if errorlevel 1 (
+    echo [ERRO] %BENCH_NAME%: mysqlslap falhou.
+    type "%BENCH_ERR%"
+    endlocal & set "BENCH_FAILED=1" & exit /b 1
+)
+
+:: Linha do CSV do mysqlslap: ,query,media,min,max,clientes,consultas.
+:: O primeiro campo (engine) vem vazio e o for /f o ignora.
+for /f "usebackq tokens=2-4 delims=," %%A in ("%BENCH_TMP%") do (
+    call :SecondsToMs %%A AVG_MS
+    call :SecondsToMs %%B MIN_MS
+    call :SecondsToMs %%C MAX_MS
+)
+
+if not defined AVG_MS (
+    echo [ERRO] %BENCH_NAME%: saida do mysqlslap nao reconhecida em "%BENCH_TMP%".
+    endlocal & set "BENCH_FAILED=1" & exit /b 1
+)
+
+>>"%BENCH_RESULT%" echo %BENCH_NAME%,%AVG_MS%,%MIN_MS%,%MAX_MS%
+
+if exist "%BENCH_BASELINE%" (
+    for /f "usebackq tokens=1,2 delims=," %%A in ("%BENCH_BASELINE%") do (
+        if /I "%%A"=="%BENCH_NAME%" set "BASE_MS=%%B"
+    )
+)
+
+if not defined BASE_MS (
+    echo [OK] %BENCH_NAME%: media %AVG_MS% ms ^(min %MIN_MS%, max %MAX_MS%^) - sem baseline
+) else if "%BASE_MS%"=="0" (
+    echo [OK] %BENCH_NAME%: media %AVG_MS% ms ^(min %MIN_MS%, max %MAX_MS%^) - baseline 0 ms
+) else (
+    set /a "DELTA=(AVG_MS - BASE_MS) * 100 / BASE_MS"
+    if !DELTA! GTR %BENCH_TOLERANCE% (
+        set "IS_REGRESSION=1"
+        echo [ALERTA] %BENCH_NAME%: media %AVG_MS% ms vs baseline %BASE_MS% ms ^(+!DELTA!%%^)
+    ) else (
+        echo [OK] %BENCH_NAME%: media %AVG_MS% ms vs baseline %BASE_MS% ms ^(!DELTA!%%^)
+    )
+)
+
+endlocal & set /a REGRESSIONS+=%IS_REGRESSION% >nul
+exit /b 0
+
+:SecondsToMs
+setlocal
+set "RAW=%~1"
+set "RAW=%RAW:.=%"
+:strip_leading_zero
+if "%RAW:~0,1%"=="0" if not "%RAW%"=="0" (
+    set "RAW=%RAW:~1%"
+    goto strip_leading_zero
+)
+endlocal & set "%~2=%RAW%"
+exit /b 0
+
+:NormalizeWinPath
+setlocal
+set "RAW=%~1"
+set "RAW=%RAW:/=\%"
+if "%RAW:~-1%"=="\" set "RAW=%RAW:~0,-1%"
+endlocal & set "%~2=%RAW%"
+exit /b 0
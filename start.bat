@@ -19,8 +19,27 @@ set "MARIADB_PORT_CANDIDATES=3306 3307 3308 3310"
 set "LARAVEL_PORT_CANDIDATES=8000 8080 8888"
 set "LARAVEL_HOST=127.0.0.1"
 set "TEMP_SQL=%BASE%temp.sql"
+set "LOGS_DIR=%BASE%logs"
+set "MARIADB_PORT_FILE=%LOGS_DIR%\mariadb.port"
 set "ARTISAN_AVAILABLE=0"
 
+:: Ajustes de desempenho do MariaDB (detalhes em docs\desempenho_mariadb.md).
+:: Passados na linha de comando para valer mesmo com um my.ini antigo no pendrive.
+set "MARIADB_OPTS="
+set "MARIADB_OPTS=%MARIADB_OPTS% --innodb-autoinc-lock-mode=2"
+set "MARIADB_OPTS=%MARIADB_OPTS% --net-buffer-length=65536"
+set "MARIADB_OPTS=%MARIADB_OPTS% --log-slow-rate-limit=20"
+set "MARIADB_OPTS=%MARIADB_OPTS% --log-slow-verbosity=query_plan,explain"
+set "MARIADB_OPTS=%MARIADB_OPTS% --plugin-load-add=query_response_time.dll"
+set "MARIADB_OPTS=%MARIADB_OPTS% --loose-query-response-time-stats=ON"
+set "MARIADB_OPTS=%MARIADB_OPTS% --loose-query-response-time-range-base=2"
+set "MARIADB_OPTS=%MARIADB_OPTS% --query-alloc-block-size=32768"
+set "MARIADB_OPTS=%MARIADB_OPTS% --query-prealloc-size=65536"
+set "MARIADB_OPTS=%MARIADB_OPTS% --character-set-server=utf8mb4"
+set "MARIADB_OPTS=%MARIADB_OPTS% --collation-server=utf8mb4_unicode_ci"
+set "MARIADB_OPTS=%MARIADB_OPTS% --table-definition-cache=1024"
+set "MARIADB_OPTS=%MARIADB_OPTS% --innodb-sort-buffer-size=4194304"
+
 if not exist "%MARIADB_DIR%" (
     echo [ERRO] Pasta do MariaDB nao encontrada em "%MARIADB_DIR%".
     echo        Rode SETAUP.BAT para recriar a estrutura e depois execute setup.bat.
@@ -95,7 +114,7 @@ if not defined MARIADB_PORT (
 
 netstat -ano | findstr /R ":!MARIADB_PORT!.*LISTENING" >nul || (
     echo Iniciando MariaDB na porta !MARIADB_PORT!...
-    start "" /b /D "%MARIADB_DIR%" "%MARIADB_BIN%" --defaults-file="%MARIADB_INI%" --port=!MARIADB_PORT! --bind-address=%LARAVEL_HOST%
+    start "" /b /D "%MARIADB_DIR%" "%MARIADB_BIN%" --defaults-file="%MARIADB_INI%" --port=!MARIADB_PORT! --bind-address=%LARAVEL_HOST% %MARIADB_OPTS%
     set "tentativas=0"
     :aguarda_mariadb
     timeout /t 1 >nul
@@ -108,6 +127,10 @@ netstat -ano | findstr /R ":!MARIADB_PORT!.*LISTENING" >nul || (
     )
 )
 
+:: Registra a porta escolhida para outros scripts (benchmark.bat) acharem este servidor.
+if not exist "%LOGS_DIR%" mkdir "%LOGS_DIR%" >nul 2>&1
+>"%MARIADB_PORT_FILE%" echo !MARIADB_PORT!
+
 if not exist "%PROJETOS_DIR%" (
     echo [INFO] Pasta de projetos nao encontrada. Criando em "%PROJETOS_DIR%"...
     mkdir "%PROJETOS_DIR%" >nul 2>&1
@@ -262,7 +285,7 @@ set /P "RUNMIG=Deseja CRIAR o banco '!DB_DATABASE!' e rodar migrations? [S/n] "
 if /I "!RUNMIG!"=="s" (
     echo.
     echo Criando banco se nao existir...
-    echo CREATE DATABASE IF NOT EXISTS `!DB_DATABASE!`;>"%TEMP_SQL%"
+    echo CREATE DATABASE IF NOT EXISTS `!DB_DATABASE!` CHARACTER SET utf8mb4 COLLATE utf8mb4_unicode_ci;>"%TEMP_SQL%"
     "%MARIADB_MYSQL%" -u root -h %LARAVEL_HOST% -P !MARIADB_PORT! < "%TEMP_SQL%"
     del /Q "%TEMP_SQL%" >nul 2>&1
 